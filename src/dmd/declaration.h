@@ -505,6 +505,7 @@ public:
     PINLINE inlining;
 
     int inlineNest;                     // !=0 if nested inline
+    int inlineCost;                     // cost of inlining, valid once inlineStatus is ILS.yes
     bool isArrayOp;                     // true if array operation
     bool eh_none;                       /// true if no exception unwinding is needed
 
@@ -15,6 +15,7 @@
 struct ModuleDeclaration;
 struct Escape;
 struct FileBuffer;
+struct SearchCacheEntry;
 
 struct MacroTable
 {
@@ -86,9 +87,7 @@ public:
     bool rootImports();         // returns true if module imports root module
 
     int insearch;
-    Identifier *searchCacheIdent;
-    Dsymbol *searchCacheSymbol; // cached value of search
-    int searchCacheFlags;       // cached flags
+    SearchCacheEntry *searchCache; // memo of search results, allocated on first use
 
     // module from command line we're imported from,
     // i.e. a module that will be taken all the
@@ -12,6 +12,9 @@
 #include "object.h"
 #include "rmem.h"
 
+// Bytes of inline storage in each Array; must match SMALLARRAYBYTES in array.d
+#define SMALLARRAYBYTES (4 * sizeof(void *))
+
 template <typename TYPE>
 struct Array
 {
@@ -19,7 +22,7 @@ struct Array
 
   private:
     DArray<TYPE> data;
-    #define SMALLARRAYCAP       1
+    static const d_size_t SMALLARRAYCAP = sizeof(TYPE) < SMALLARRAYBYTES ? SMALLARRAYBYTES / sizeof(TYPE) : 1;
     TYPE smallarray[SMALLARRAYCAP];    // inline storage for small arrays
 
     Array(const Array&);
@@ -95,9 +98,9 @@ struct Array
                     data.ptr = (TYPE *)mem.xmalloc(data.length * sizeof(TYPE));
                 }
             }
-            else if (data.length == SMALLARRAYCAP)
+            else if (data.ptr == &smallarray[0])
             {
-                data.length = length + nentries;
+                data.length = length + (nentries > length / 2 ? nentries : length / 2);
                 data.ptr = (TYPE *)mem.xmalloc(data.length * sizeof(TYPE));
                 memcpy(data.ptr, &smallarray[0], length * sizeof(TYPE));
             }